@@ -1,10 +1,10 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:19 2026
 
 #include <stddef.h>
 #include <stdint.h>
 #include <wonderful.h>
 
-const uint8_t bootstrap_multiboot[696] = {
+const uint8_t bootstrap_multiboot[716] = {
 	0x37, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -25,42 +25,44 @@ const uint8_t bootstrap_multiboot[696] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xEA,
 	0xFF, 0x04, 0x0F, 0xE2, 0x02, 0x14, 0xA0, 0xE3, 0x00, 0x00, 0x51, 0xE1,
-	0x0B, 0x00, 0x00, 0x0A, 0xFE, 0xFF, 0xFF, 0x8A, 0x6E, 0x2F, 0x8F, 0xE2,
+	0x0B, 0x00, 0x00, 0x0A, 0xFE, 0xFF, 0xFF, 0x8A, 0x73, 0x2F, 0x8F, 0xE2,
 	0x08, 0x00, 0xB2, 0xE8, 0x03, 0x20, 0x82, 0xE0, 0x08, 0x00, 0xB2, 0xE8,
 	0x03, 0x21, 0x82, 0xE0, 0x02, 0x00, 0x50, 0xE1, 0x02, 0x00, 0x00, 0x2A,
 	0xF0, 0x0F, 0xB0, 0xE8, 0xF0, 0x0F, 0xA1, 0xE8, 0xFA, 0xFF, 0xFF, 0xEA,
 	0x02, 0xF4, 0xA0, 0xE3, 0x3C, 0x00, 0x9F, 0xE5, 0x00, 0x00, 0x80, 0xE5,
-	0x38, 0xD0, 0x9F, 0xE5, 0x06, 0x0D, 0x8F, 0xE2, 0x04, 0x00, 0xB0, 0xE8,
+	0x38, 0xD0, 0x9F, 0xE5, 0x65, 0x0F, 0x8F, 0xE2, 0x04, 0x00, 0xB0, 0xE8,
 	0x02, 0x00, 0x80, 0xE0, 0x04, 0x00, 0xB0, 0xE8, 0x28, 0x10, 0x9F, 0xE5,
 	0x02, 0x11, 0x41, 0xE0, 0x01, 0x23, 0x82, 0xE3, 0x01, 0x40, 0xA0, 0xE1,
 	0x00, 0x00, 0x0B, 0xEF, 0x01, 0x00, 0x8F, 0xE2, 0x10, 0xFF, 0x2F, 0xE1,
 	0x05, 0xA0, 0x04, 0x49, 0x12, 0xB4, 0x11, 0xDF, 0x12, 0xBC, 0x08, 0x47,
-	0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03, 0xC0, 0x7D, 0x00, 0x03,
-	0x10, 0xD8, 0x01, 0x00, 0x00, 0x07, 0x00, 0xB4, 0xE8, 0x00, 0x00, 0x50,
-	0xE3, 0x00, 0x11, 0xFF, 0x2F, 0x01, 0x01, 0x01, 0x12, 0xE3, 0x05, 0x05,
-	0x00, 0x00, 0x1A, 0x02, 0x00, 0x07, 0x0F, 0x10, 0x07, 0x00, 0x02, 0x12,
-	0xE3, 0x00, 0x00, 0x12, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x0F, 0xF4, 0xFF,
-	0xFF, 0xEA, 0x0F, 0x00, 0x22, 0xC2, 0xE3, 0x02, 0x00, 0x80, 0xE0, 0x81,
-	0x00, 0x37, 0xA0, 0xE3, 0x02, 0x20, 0x43, 0xE0, 0x14, 0x00, 0x00, 0x2D,
-	0xE9, 0x03, 0x00, 0x52, 0xE1, 0x02, 0x00, 0x00, 0x00, 0x2A, 0xF0, 0x0F,
-	0x30, 0xE9, 0xF0, 0x08, 0x0F, 0x23, 0xE9, 0xFA, 0x00, 0x27, 0x11, 0x00,
-	0xBD, 0x20, 0xE8, 0xFF, 0x00, 0x2F, 0x01, 0x80, 0xD0, 0xE4, 0x01, 0x00,
-	0x80, 0xC1, 0xE4, 0x68, 0x31, 0x9F, 0xE5, 0x00, 0x00, 0x60, 0xA0, 0xE3,
-	0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x02, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12,
-	0x10, 0x33, 0x1A, 0xB0, 0x50, 0x1F, 0xF7, 0x00, 0x5B, 0x90, 0x1B, 0x26,
-	0x00, 0x00, 0x0A, 0xA4, 0x90, 0x2B, 0x17, 0x00, 0x0F, 0x00, 0x50, 0xB0,
-	0x3F, 0x01, 0x50, 0x03, 0x85, 0x12, 0x85, 0x50, 0xA0, 0xE1, 0xF0, 0x13,
-	0xF0, 0x13, 0x80, 0xF0, 0x27, 0x85, 0x12, 0x00, 0x00, 0x55, 0xE3, 0x05,
-	0x00, 0x50, 0x51, 0x17, 0x01, 0x50, 0xC1, 0xE4, 0xD7, 0x80, 0x10, 0xAB,
-	0x50, 0xD0, 0xE4, 0xA5, 0x70, 0xB0, 0xE1, 0x42, 0x2E, 0x00, 0x7B, 0x07,
-	0x80, 0x51, 0x27, 0x00, 0xB7, 0x24, 0xB5, 0x00, 0x07, 0xE7, 0x10, 0xBF,
-	0x50, 0x07, 0x01, 0x00, 0xC3, 0xCD, 0x01, 0x07, 0x00, 0x1A, 0x00, 0x00,
-	0xEB, 0x02, 0x50, 0x45, 0xE2, 0x07, 0x00, 0x00, 0x56, 0xE3, 0x09, 0x10,
-	0xC7, 0x00, 0xDB, 0x20, 0x4F, 0xB0, 0x01, 0x3B, 0x13, 0x00, 0x1B, 0x60,
-	0x2F, 0x50, 0x55, 0xE2, 0xFB, 0x09, 0xFF, 0xFF, 0x1A, 0xC0, 0x20, 0x5F,
-	0x45, 0xE2, 0x11, 0x0F, 0x04, 0x05, 0x74, 0x88, 0xE0, 0x0A, 0x00, 0x3F,
-	0x7D, 0x0C, 0x24, 0x57, 0xE3, 0x00, 0xC3, 0xA2, 0x05, 0x40, 0x07, 0x80,
-	0x00, 0x02, 0x57, 0xE3, 0x02, 0x50, 0x85, 0xB2, 0xD0, 0x3B, 0xB1, 0x92,
-	0x20, 0x9B, 0xA0, 0xE3, 0xF0, 0xEB, 0x85, 0x12, 0x91, 0x4F, 0xF6, 0x83,
-	0x00, 0x67, 0x1E, 0xFF, 0x2F, 0xE1, 0x8A, 0x11, 0x77, 0x01, 0xC9, 0x00
+	0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03, 0x80, 0x7D, 0x00, 0x03,
+	0x10, 0xF0, 0x01, 0x00, 0x00, 0x07, 0x00, 0xB4, 0xE8, 0x00, 0x00, 0x50,
+	0xE3, 0x00, 0x11, 0xFF, 0x2F, 0x01, 0x01, 0x01, 0x12, 0xE3, 0x05, 0x0B,
+	0x00, 0x00, 0x1A, 0x02, 0x00, 0x07, 0x15, 0x00, 0x07, 0x00, 0x01, 0x02,
+	0x12, 0xE3, 0x00, 0x00, 0x18, 0x1F, 0x02, 0xF5, 0xFF, 0xFF, 0x1A, 0x02,
+	0x03, 0x10, 0x0B, 0x17, 0x30, 0x1F, 0xF2, 0x10, 0x0B, 0x20, 0x17, 0x12,
+	0x1F, 0x00, 0x00, 0x00, 0x0B, 0x0F, 0xEE, 0xFF, 0xFF, 0xEA, 0x0F, 0x22,
+	0x00, 0xC2, 0xE3, 0x02, 0x00, 0x80, 0xE0, 0x81, 0x37, 0x00, 0xA0, 0xE3,
+	0x02, 0x20, 0x43, 0xE0, 0x14, 0x00, 0x00, 0x2D, 0xE9, 0x03, 0x00, 0x52,
+	0xE1, 0x02, 0x00, 0x00, 0x00, 0x2A, 0xF0, 0x0F, 0x30, 0xE9, 0xF0, 0x0F,
+	0x10, 0x23, 0xE9, 0xFA, 0x00, 0x27, 0x11, 0x00, 0xBD, 0xE8, 0x40, 0xFF,
+	0x00, 0x07, 0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0x00, 0xC1, 0xE4, 0x68,
+	0x31, 0x9F, 0xE5, 0x00, 0x60, 0x00, 0xA0, 0xE3, 0xE3, 0x30, 0xB0, 0xE1,
+	0x01, 0x20, 0x05, 0xD0, 0x24, 0x03, 0x00, 0x12, 0x10, 0x33, 0x1A, 0x50,
+	0x1F, 0x61, 0xF7, 0x00, 0x2B, 0x90, 0x1B, 0x26, 0x00, 0x00, 0x0A, 0x90,
+	0x0F, 0x48, 0x17, 0x00, 0x0F, 0x00, 0x50, 0xB0, 0x3F, 0x01, 0x50, 0x85,
+	0x07, 0x12, 0x85, 0x50, 0xA0, 0xE1, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13,
+	0x00, 0x85, 0x12, 0x00, 0x00, 0x55, 0xE3, 0x05, 0x50, 0x01, 0x51, 0x17,
+	0x01, 0x50, 0xC1, 0xE4, 0xD7, 0x10, 0xAB, 0x00, 0x50, 0xD0, 0xE4, 0xA5,
+	0x70, 0xB0, 0xE1, 0x2E, 0x85, 0x00, 0x6B, 0x07, 0x80, 0x51, 0x27, 0x00,
+	0x97, 0x24, 0x00, 0x07, 0x6A, 0xE7, 0x10, 0x9F, 0x50, 0x07, 0x01, 0x00,
+	0xC3, 0xCD, 0x00, 0x2B, 0x1A, 0x00, 0x00, 0x00, 0xEB, 0x02, 0x50, 0x45,
+	0xE2, 0x00, 0x0F, 0x00, 0x56, 0xE3, 0x09, 0x10, 0xC7, 0x00, 0x17, 0x20,
+	0x4F, 0x00, 0x0B, 0x61, 0x13, 0x00, 0x1B, 0x60, 0x2F, 0x50, 0x55, 0xE2,
+	0xFB, 0x01, 0x47, 0x48, 0xC0, 0x20, 0x5F, 0x45, 0xE2, 0x10, 0xEF, 0x05,
+	0x74, 0x88, 0x21, 0xE0, 0x0A, 0x00, 0x23, 0x7D, 0x0C, 0x57, 0xE3, 0x00,
+	0x87, 0x20, 0xA2, 0x05, 0x40, 0x07, 0x80, 0x00, 0x57, 0xE3, 0x02, 0x14,
+	0x50, 0x85, 0xB2, 0xD0, 0x3B, 0xB1, 0x20, 0x3B, 0xA0, 0xE3, 0x94, 0xF0,
+	0xC3, 0x85, 0x12, 0x90, 0x0F, 0xF6, 0x00, 0x2B, 0x1E, 0xFF, 0x18, 0x2F,
+	0xE1, 0x84, 0x10, 0x2F, 0x01, 0xE1, 0x00, 0x00
 };
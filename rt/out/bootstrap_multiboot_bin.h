@@ -1,9 +1,9 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:19 2026
 
 #pragma once
 #include <stddef.h>
 #include <stdint.h>
 #include <wonderful.h>
 
-#define bootstrap_multiboot_size (696)
-extern const uint8_t bootstrap_multiboot[696];
+#define bootstrap_multiboot_size (716)
+extern const uint8_t bootstrap_multiboot[716];
@@ -1,4 +1,4 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:20 2026
 
 #include <stddef.h>
 #include <stdint.h>
@@ -35,7 +35,7 @@ const uint8_t bootstrap_multiboot_nopack[416] = {
 	0x02, 0x11, 0x41, 0xE0, 0x01, 0x23, 0x82, 0xE3, 0x01, 0x40, 0xA0, 0xE1,
 	0x00, 0x00, 0x0B, 0xEF, 0x01, 0x00, 0x8F, 0xE2, 0x10, 0xFF, 0x2F, 0xE1,
 	0x05, 0xA0, 0x04, 0x49, 0x12, 0xB4, 0x11, 0xDF, 0x12, 0xBC, 0x08, 0x47,
-	0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03, 0xC0, 0x7D, 0x00, 0x03,
+	0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03, 0x80, 0x7D, 0x00, 0x03,
 	0x10, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0xB4, 0xE8, 0x00, 0x00, 0x50,
 	0xE3, 0x00, 0x11, 0xFF, 0x2F, 0x01, 0x02, 0x01, 0x12, 0xE3, 0x02, 0x00,
 	0x00, 0x11, 0x1F, 0x02, 0x02, 0x10, 0x07, 0x12, 0x00, 0x1F, 0x00, 0x00,
@@ -1,4 +1,4 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:20 2026
 
 #pragma once
 #include <stddef.h>
@@ -0,0 +1,9 @@
+// autogenerated by wf-bin2c on Sun Oct 18 09:05:31 2026
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <wonderful.h>
+
+#define bootstrap_multiboot_profile_size (788)
+extern const uint8_t bootstrap_multiboot_profile[788];
@@ -1,16 +1,18 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:18 2026
 
 #include <stddef.h>
 #include <stdint.h>
 #include <wonderful.h>
 
-const uint8_t bootstrap_rom[452] = {
-	0x38, 0x00, 0x9F, 0xE5, 0x00, 0x00, 0x80, 0xE5, 0x34, 0xD0, 0x9F, 0xE5,
-	0x1B, 0x4E, 0x8F, 0xE2, 0x01, 0x00, 0xB4, 0xE8, 0x00, 0x40, 0x84, 0xE0,
+const uint8_t bootstrap_rom[476] = {
+	0x50, 0x00, 0x9F, 0xE5, 0x00, 0x00, 0x80, 0xE5, 0x4C, 0xD0, 0x9F, 0xE5,
+	0x72, 0x4F, 0x8F, 0xE2, 0x01, 0x00, 0xB4, 0xE8, 0x00, 0x40, 0x84, 0xE0,
 	0x04, 0x40, 0x84, 0xE2, 0x07, 0x00, 0xB4, 0xE8, 0x00, 0x00, 0x50, 0xE3,
-	0x11, 0xFF, 0x2F, 0x01, 0x02, 0x01, 0x12, 0xE3, 0x05, 0x00, 0x00, 0x1A,
+	0x11, 0xFF, 0x2F, 0x01, 0x02, 0x01, 0x12, 0xE3, 0x0B, 0x00, 0x00, 0x1A,
+	0x01, 0x02, 0x12, 0xE3, 0x00, 0x00, 0x18, 0x1F, 0xF7, 0xFF, 0xFF, 0x1A,
+	0x02, 0x03, 0x12, 0xE3, 0x00, 0x00, 0x17, 0x1F, 0xF4, 0xFF, 0xFF, 0x1A,
 	0x02, 0x02, 0x12, 0xE3, 0x00, 0x00, 0x12, 0x1F, 0x00, 0x00, 0x0B, 0x0F,
-	0xF6, 0xFF, 0xFF, 0xEA, 0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03,
+	0xF0, 0xFF, 0xFF, 0xEA, 0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03,
 	0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0xC1, 0xE4, 0x68, 0x31, 0x9F, 0xE5,
 	0x00, 0x60, 0xA0, 0xE3, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
 	0x03, 0x00, 0x12, 0xE1, 0x02, 0x00, 0x00, 0x1A, 0x01, 0x80, 0xD0, 0xE4,
@@ -42,5 +44,5 @@ const uint8_t bootstrap_rom[452] = {
 	0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
 	0x01, 0x50, 0x85, 0x12, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
 	0x03, 0x00, 0x12, 0xE1, 0xF6, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1,
-	0x96, 0xFF, 0xFF, 0xEA, 0x01, 0x01, 0x01, 0x01
+	0x90, 0xFF, 0xFF, 0xEA, 0x01, 0x01, 0x01, 0x01
 };
@@ -1,9 +1,9 @@
-// autogenerated by wf-bin2c on Tue Sep  2 17:17:42 2025
+// autogenerated by wf-bin2c on Sun Oct 18 08:37:18 2026
 
 #pragma once
 #include <stddef.h>
 #include <stdint.h>
 #include <wonderful.h>
 
-#define bootstrap_rom_size (452)
-extern const uint8_t bootstrap_rom[452];
+#define bootstrap_rom_size (476)
+extern const uint8_t bootstrap_rom[476];
@@ -0,0 +1,54 @@
+// autogenerated by wf-bin2c on Sun Oct 18 09:05:30 2026
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wonderful.h>
+
+const uint8_t bootstrap_rom_profile[552] = {
+	0x98, 0x00, 0x9F, 0xE5, 0x00, 0x00, 0x80, 0xE5, 0x94, 0xD0, 0x9F, 0xE5,
+	0x85, 0x4F, 0x8F, 0xE2, 0x01, 0x00, 0xB4, 0xE8, 0x00, 0x40, 0x84, 0xE0,
+	0x04, 0x40, 0x84, 0xE2, 0x04, 0xC0, 0x94, 0xE5, 0x0C, 0x40, 0x84, 0xE2,
+	0x7C, 0x00, 0x9F, 0xE5, 0x00, 0x10, 0xA0, 0xE3, 0x00, 0x10, 0x80, 0xE5,
+	0x04, 0x10, 0x80, 0xE5, 0x21, 0x17, 0xA0, 0xE3, 0x04, 0x10, 0x80, 0xE5,
+	0x02, 0x15, 0xA0, 0xE3, 0x00, 0x10, 0x80, 0xE5, 0x5C, 0x00, 0x9F, 0xE5,
+	0xB4, 0x20, 0xD0, 0xE1, 0xB0, 0x10, 0xD0, 0xE1, 0xB4, 0x30, 0xD0, 0xE1,
+	0x03, 0x00, 0x52, 0xE1, 0xFA, 0xFF, 0xFF, 0x1A, 0x02, 0x18, 0x81, 0xE1,
+	0x04, 0x10, 0x8C, 0xE4, 0x07, 0x00, 0xB4, 0xE8, 0x00, 0x00, 0x50, 0xE3,
+	0x11, 0xFF, 0x2F, 0x01, 0x02, 0x01, 0x12, 0xE3, 0x0C, 0x00, 0x00, 0x1A,
+	0x01, 0x02, 0x12, 0xE3, 0x00, 0x00, 0x18, 0x1F, 0xEF, 0xFF, 0xFF, 0x1A,
+	0x02, 0x03, 0x12, 0xE3, 0x00, 0x00, 0x17, 0x1F, 0xEC, 0xFF, 0xFF, 0x1A,
+	0x02, 0x02, 0x12, 0xE3, 0x00, 0x00, 0x12, 0x1F, 0x00, 0x00, 0x0B, 0x0F,
+	0xE8, 0xFF, 0xFF, 0xEA, 0x08, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x03,
+	0x08, 0x01, 0x00, 0x04, 0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0xC1, 0xE4,
+	0x68, 0x31, 0x9F, 0xE5, 0x00, 0x60, 0xA0, 0xE3, 0xE3, 0x30, 0xB0, 0xE1,
+	0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x02, 0x00, 0x00, 0x1A,
+	0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0xC1, 0xE4, 0xF7, 0xFF, 0xFF, 0xEA,
+	0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
+	0x26, 0x00, 0x00, 0x0A, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
+	0x03, 0x00, 0x12, 0xE1, 0x17, 0x00, 0x00, 0x0A, 0x00, 0x50, 0xA0, 0xE3,
+	0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
+	0x01, 0x50, 0x85, 0x12, 0x85, 0x50, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1,
+	0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x01, 0x50, 0x85, 0x12,
+	0x85, 0x50, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
+	0x03, 0x00, 0x12, 0xE1, 0x01, 0x50, 0x85, 0x12, 0x85, 0x50, 0xA0, 0xE1,
+	0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
+	0x01, 0x50, 0x85, 0x12, 0x00, 0x00, 0x55, 0xE3, 0x05, 0x50, 0x51, 0x17,
+	0x01, 0x50, 0xC1, 0xE4, 0xD7, 0xFF, 0xFF, 0xEA, 0x01, 0x50, 0xD0, 0xE4,
+	0xA5, 0x70, 0xB0, 0xE1, 0x2E, 0x00, 0x00, 0x0A, 0x07, 0x80, 0x51, 0x27,
+	0x01, 0x80, 0xC1, 0x24, 0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4,
+	0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4, 0x01, 0x60, 0xA0, 0xE3,
+	0xCD, 0xFF, 0xFF, 0xEA, 0x1A, 0x00, 0x00, 0xEB, 0x02, 0x50, 0x45, 0xE2,
+	0x00, 0x00, 0x56, 0xE3, 0x09, 0x00, 0x00, 0x1A, 0x01, 0x60, 0xA0, 0xE3,
+	0x00, 0x00, 0x55, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0x13, 0x00, 0x00, 0xEB,
+	0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4, 0x01, 0x50, 0x55, 0xE2,
+	0xFB, 0xFF, 0xFF, 0x1A, 0xC0, 0xFF, 0xFF, 0xEA, 0x01, 0x50, 0x45, 0xE2,
+	0x01, 0x80, 0xD0, 0xE4, 0x05, 0x74, 0x88, 0xE0, 0x0A, 0x00, 0x00, 0xEB,
+	0x7D, 0x0C, 0x57, 0xE3, 0x01, 0x50, 0x85, 0xA2, 0x05, 0x0C, 0x57, 0xE3,
+	0x01, 0x50, 0x85, 0xA2, 0x80, 0x00, 0x57, 0xE3, 0x02, 0x50, 0x85, 0xB2,
+	0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4, 0x01, 0x50, 0x55, 0xE2,
+	0xFB, 0xFF, 0xFF, 0x1A, 0xB1, 0xFF, 0xFF, 0xEA, 0x01, 0x50, 0xA0, 0xE3,
+	0x85, 0x50, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
+	0x03, 0x00, 0x12, 0xE1, 0x01, 0x50, 0x85, 0x12, 0xE3, 0x30, 0xB0, 0xE1,
+	0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0xF6, 0xFF, 0xFF, 0x1A,
+	0x1E, 0xFF, 0x2F, 0xE1, 0x87, 0xFF, 0xFF, 0xEA, 0x01, 0x01, 0x01, 0x01
+};
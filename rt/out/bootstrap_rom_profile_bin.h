@@ -0,0 +1,9 @@
+// autogenerated by wf-bin2c on Sun Oct 18 09:05:30 2026
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <wonderful.h>
+
+#define bootstrap_rom_profile_size (552)
+extern const uint8_t bootstrap_rom_profile[552];
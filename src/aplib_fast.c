@@ -0,0 +1,257 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "aplib_fast.h"
+
+#define HASH_BITS 16
+#define HASH_SIZE (1 << HASH_BITS)
+#define MAX_CHAIN_DEPTH 32
+// Stop searching the hash chain once a match this long has been found.
+#define GOOD_MATCH_LENGTH 64
+// Cost of a plain literal: one tag bit and one byte.
+#define LITERAL_BITS 9
+
+typedef struct {
+    uint8_t *dest;
+    size_t pos;
+    size_t size;
+    size_t tag_pos;
+    int tag_bits;
+    bool overflow;
+} bit_writer_t;
+
+typedef struct {
+    uint32_t length;
+    uint32_t offset;
+    int gain;
+} match_t;
+
+static void put_byte(bit_writer_t *w, uint8_t value) {
+    if (w->pos >= w->size) {
+        w->overflow = true;
+        return;
+    }
+    w->dest[w->pos++] = value;
+}
+
+// Tag bits are packed MSB first into a byte reserved in the stream at the
+// point the first bit of the group is written, as the decoder expects.
+static void put_bit(bit_writer_t *w, int bit) {
+    if (!w->tag_bits) {
+        w->tag_pos = w->pos;
+        put_byte(w, 0);
+        w->tag_bits = 8;
+    }
+    w->tag_bits--;
+    if (bit && !w->overflow) w->dest[w->tag_pos] |= 1 << w->tag_bits;
+}
+
+// Elias gamma variant used by aPLib: value >= 2.
+static void put_gamma(bit_writer_t *w, uint32_t value) {
+    int top = 31 - __builtin_clz(value);
+    for (int i = top - 1; i >= 0; i--) {
+        put_bit(w, (value >> i) & 1);
+        put_bit(w, i > 0);
+    }
+}
+
+static int gamma_bits(uint32_t value) {
+    return (31 - __builtin_clz(value)) * 2;
+}
+
+static int match_length_adjust(uint32_t offset) {
+    return (offset >= 32000) + (offset >= 1280) + (offset < 128 ? 2 : 0);
+}
+
+// Returns the size of a match in bits, or -1 if it cannot be encoded.
+// "lwm" is set if the previous command was a match, which disables the
+// repeat-offset encoding and shifts the high offset byte by one.
+static int match_bits(uint32_t length, uint32_t offset, uint32_t rep_offset, bool lwm) {
+    if (length < 2) return -1;
+    if (!lwm && offset == rep_offset) return 2 + gamma_bits(2) + gamma_bits(length);
+    if (offset < 128 && length <= 3) return 3 + 8;
+    uint32_t adjust = match_length_adjust(offset);
+    if (length < adjust + 2) return -1;
+    return 2 + gamma_bits((offset >> 8) + (lwm ? 2 : 3)) + 8 + gamma_bits(length - adjust);
+}
+
+static uint32_t match_length_at(const uint8_t *source, size_t length, size_t pos, uint32_t offset) {
+    uint32_t max = length - pos;
+    uint32_t i = 0;
+    while (i < max && source[pos + i] == source[pos + i - offset]) i++;
+    return i;
+}
+
+static inline uint32_t hash3(const uint8_t *p) {
+    uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+typedef struct {
+    const uint8_t *source;
+    size_t length;
+    size_t window_size;
+    int32_t *head;
+    int32_t *prev;
+    size_t inserted;
+} match_finder_t;
+
+static void insert_until(match_finder_t *mf, size_t pos) {
+    while (mf->inserted < pos) {
+        size_t i = mf->inserted++;
+        if (i + 3 > mf->length) continue;
+        uint32_t h = hash3(mf->source + i);
+        mf->prev[i] = mf->head[h];
+        mf->head[h] = i;
+    }
+}
+
+static match_t find_match(match_finder_t *mf, size_t pos, uint32_t rep_offset, bool lwm) {
+    match_t best = {0, 0, 0};
+    insert_until(mf, pos);
+
+    if (!lwm && rep_offset && rep_offset <= pos) {
+        uint32_t len = match_length_at(mf->source, mf->length, pos, rep_offset);
+        int bits = match_bits(len, rep_offset, rep_offset, lwm);
+        if (bits >= 0 && (int) (len * LITERAL_BITS) - bits > best.gain) {
+            best = (match_t) {len, rep_offset, len * LITERAL_BITS - bits};
+        }
+    }
+
+    if (pos + 3 > mf->length) return best;
+
+    int32_t candidate = mf->head[hash3(mf->source + pos)];
+    for (int depth = 0; candidate >= 0 && depth < MAX_CHAIN_DEPTH; depth++, candidate = mf->prev[candidate]) {
+        uint32_t offset = pos - candidate;
+        if (offset > mf->window_size) break;
+        if (best.length && (pos + best.length >= mf->length
+            || mf->source[candidate + best.length] != mf->source[pos + best.length])) continue;
+
+        uint32_t len = match_length_at(mf->source, mf->length, pos, offset);
+        int bits = match_bits(len, offset, rep_offset, lwm);
+        if (bits >= 0 && (int) (len * LITERAL_BITS) - bits > best.gain) {
+            best = (match_t) {len, offset, len * LITERAL_BITS - bits};
+            if (len >= GOOD_MATCH_LENGTH) break;
+        }
+    }
+
+    return best;
+}
+
+static void put_literal(bit_writer_t *w, const uint8_t *source, size_t pos) {
+    uint8_t value = source[pos];
+
+    // Zero bytes and bytes repeated within the last 15 fit in a 7-bit code.
+    int short_offset = -1;
+    if (!value) {
+        short_offset = 0;
+    } else {
+        for (size_t i = 1; i <= 15 && i <= pos; i++) {
+            if (source[pos - i] == value) {
+                short_offset = i;
+                break;
+            }
+        }
+    }
+
+    if (short_offset >= 0) {
+        put_bit(w, 1);
+        put_bit(w, 1);
+        put_bit(w, 1);
+        for (int i = 3; i >= 0; i--) put_bit(w, (short_offset >> i) & 1);
+    } else {
+        put_bit(w, 0);
+        put_byte(w, value);
+    }
+}
+
+static void put_match(bit_writer_t *w, uint32_t length, uint32_t offset, uint32_t rep_offset, bool lwm) {
+    if (!lwm && offset == rep_offset) {
+        put_bit(w, 1);
+        put_bit(w, 0);
+        put_gamma(w, 2);
+        put_gamma(w, length);
+    } else if (offset < 128 && length <= 3) {
+        put_bit(w, 1);
+        put_bit(w, 1);
+        put_bit(w, 0);
+        put_byte(w, (offset << 1) | (length - 2));
+    } else {
+        put_bit(w, 1);
+        put_bit(w, 0);
+        put_gamma(w, (offset >> 8) + (lwm ? 2 : 3));
+        put_byte(w, offset & 0xFF);
+        put_gamma(w, length - match_length_adjust(offset));
+    }
+}
+
+void aplib_fast_free(aplib_fast_ctx_t *ctx) {
+    free(ctx->head);
+    free(ctx->prev);
+    memset(ctx, 0, sizeof(aplib_fast_ctx_t));
+}
+
+int aplib_fast_compress_ctx(aplib_fast_ctx_t *ctx, const uint8_t *source, uint8_t *dest, size_t length, size_t dest_size, size_t window_size) {
+    if (!length) return -1;
+
+    if (ctx->head == NULL) {
+        ctx->head = malloc(HASH_SIZE * sizeof(int32_t));
+        if (ctx->head == NULL) return -1;
+    }
+    if (ctx->prev_size < length) {
+        free(ctx->prev);
+        ctx->prev = malloc(length * sizeof(int32_t));
+        ctx->prev_size = ctx->prev != NULL ? length : 0;
+        if (ctx->prev == NULL) return -1;
+    }
+
+    match_finder_t mf;
+    mf.source = source;
+    mf.length = length;
+    mf.window_size = window_size ? window_size : length;
+    mf.inserted = 0;
+    mf.head = ctx->head;
+    mf.prev = ctx->prev;
+    memset(mf.head, 0xFF, HASH_SIZE * sizeof(int32_t));
+
+    bit_writer_t w;
+    memset(&w, 0, sizeof(w));
+    w.dest = dest;
+    w.size = dest_size;
+
+    // The first byte is always stored as-is.
+    put_byte(&w, source[0]);
+
+    uint32_t rep_offset = 0;
+    bool lwm = false;
+    size_t pos = 1;
+    while (pos < length && !w.overflow) {
+        match_t match = find_match(&mf, pos, rep_offset, lwm);
+
+        // Lazy evaluation: prefer a literal if the next position yields a
+        // better match.
+        if (match.gain > 0 && pos + 1 < length) {
+            match_t next = find_match(&mf, pos + 1, rep_offset, false);
+            if (next.gain > match.gain) match.gain = 0;
+        }
+
+        if (match.gain > 0) {
+            put_match(&w, match.length, match.offset, rep_offset, lwm);
+            rep_offset = match.offset;
+            lwm = true;
+            pos += match.length;
+        } else {
+            put_literal(&w, source, pos);
+            lwm = false;
+            pos++;
+        }
+    }
+
+    // End of stream marker.
+    put_bit(&w, 1);
+    put_bit(&w, 1);
+    put_bit(&w, 0);
+    put_byte(&w, 0);
+
+    return w.overflow ? -1 : (int) w.pos;
+}
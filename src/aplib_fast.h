@@ -0,0 +1,31 @@
+#ifndef APLIB_FAST_H_
+#define APLIB_FAST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Match finder workspace, kept across calls to avoid reallocating it for
+ * every section. A zero-initialized context is valid. Contexts are not
+ * shared; use one per thread.
+ */
+typedef struct {
+    int32_t *head;
+    int32_t *prev;
+    size_t prev_size;
+} aplib_fast_ctx_t;
+
+/**
+ * Release the workspace held by a context.
+ */
+void aplib_fast_free(aplib_fast_ctx_t *ctx);
+
+/**
+ * Compress data to a raw aPLib stream using a lazy parse and a hash-chain
+ * match finder. Much faster than apultra_compress(), at the cost of ratio.
+ *
+ * Returns the compressed size, or -1 if the output buffer is too small.
+ */
+int aplib_fast_compress_ctx(aplib_fast_ctx_t *ctx, const uint8_t *source, uint8_t *dest, size_t length, size_t dest_size, size_t window_size);
+
+#endif /* APLIB_FAST_H_ */
@@ -52,4 +52,19 @@ typedef struct __attribute__((packed)) {
     uint32_t align;
 } elf_phdr_t;
 
+#define ELF_SHF_ALLOC 0x2
+
+typedef struct __attribute__((packed)) {
+    uint32_t name;
+    uint32_t type;
+    uint32_t flags;
+    uint32_t addr;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t link;
+    uint32_t info;
+    uint32_t addralign;
+    uint32_t entsize;
+} elf_shdr_t;
+
 #endif /* ELF_H_ */
@@ -1,4 +1,5 @@
 #include "elf.h"
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -11,10 +12,13 @@
 #endif
 
 #include "libapultra.h"
+#include "aplib_fast.h"
 #include "bootstrap_multiboot_bin.h"
 #include "bootstrap_multiboot_nopack_bin.h"
+#include "bootstrap_multiboot_profile_bin.h"
 #include "bootstrap_rom_bin.h"
 #include "bootstrap_rom_nopack_bin.h"
+#include "bootstrap_rom_profile_bin.h"
 
 #define VERSION "0.3.1"
 
@@ -27,7 +31,11 @@
 #define AGB_ROM_START   0x08000000
 #define AGB_ROM_END     0x09FFFFFF
 #define AGB_ROM_SIZE    0x2000000
+// Must match STAGE2_ADDR in rt/src/stage1.S for PROFILE builds.
+#define AGB_PROFILE_STAGE2_ADDR 0x03007D00
+#define AGB_CYCLES_PER_MS 16777.216
 #define MAX(a,b) (((a) < (b)) ? (b) : (a))
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
 
 static bool phdr_supports_type(uint32_t type) {
     return type == ELF_PT_LOAD || type == ELF_PT_ARM_EXIDX;
@@ -45,8 +53,51 @@ static bool address_supports_8bit_writes(uint32_t address) {
     return address_is_ewram(address) || address_is_iwram(address);
 }
 
+#define COMPRESS_LEVEL_FAST 1
+#define COMPRESS_LEVEL_OPTIMAL 2
+
 bool verbose = false;
 const char *cue_lzss_path = NULL;
+int compress_level = COMPRESS_LEVEL_OPTIMAL;
+int incompressible_threshold = 100;
+
+#define CODEC_DEFAULT 0
+#define CODEC_APLIB 1
+#define CODEC_LZ77 2
+#define CODEC_NONE 3
+
+typedef struct {
+    int codec;
+    int level;
+    uint32_t window_size;
+    bool dedupe;
+    bool overlay;
+} section_policy_t;
+
+#define POLICY_MATCH_ADDRESS 1
+#define POLICY_MATCH_PHDR 2
+#define POLICY_MATCH_SECTION 3
+
+#define POLICY_SET_CODEC (1 << 0)
+#define POLICY_SET_LEVEL (1 << 1)
+#define POLICY_SET_WINDOW (1 << 2)
+#define POLICY_SET_DEDUPE (1 << 3)
+#define POLICY_SET_OVERLAY (1 << 4)
+
+#define MAX_POLICY_RULES 256
+#define MAX_POLICY_SECTION_NAME 64
+
+typedef struct {
+    int match_type;
+    uint32_t start, end;
+    int phdr;
+    char section[MAX_POLICY_SECTION_NAME + 1];
+    uint32_t set_mask;
+    section_policy_t policy;
+} policy_rule_t;
+
+policy_rule_t policy_rules[MAX_POLICY_RULES];
+int policy_rules_count = 0;
 
 static void *checked_malloc(size_t size) {
     void *buffer = malloc(size);
@@ -108,9 +159,18 @@ static void write_file(const char *filename, const void *buffer, size_t length)
 }
 
 static void print_help(int argc, char **argv) {
-    printf("Usage: %s [-0hv] [-L <path>] <input> <output>\n\n", argc && argv[0] ? argv[0] : "agbpack");
+    printf("Usage: %s [-01hv] [-L <path>] [-P <path>] [-p <addr>] [-t <pct>] <input> <output>\n", argc && argv[0] ? argv[0] : "agbpack");
+    printf("       %s -R <dump> <image> [<elf>]\n\n", argc && argv[0] ? argv[0] : "agbpack");
     printf("  -0         Disable compression.\n");
+    printf("  -1         Use fast, less efficient compression.\n");
     printf("  -L <path>  Use LZSS compression for VRAM data via external nnpack-lzss.\n");
+    printf("  -t <pct>   Skip compressing sections estimated to exceed <pct>%% of their\n");
+    printf("             original size (default: 100, 0 to always compress).\n");
+    printf("  -P <path>  Read per-section packing policy from file.\n");
+    printf("  -p <addr>  Use instrumented bootstrap, storing per-command boot timings\n");
+    printf("             at <addr> in EWRAM or IWRAM.\n");
+    printf("  -R <dump>  Print boot timings from a memory dump of the timing buffer;\n");
+    printf("             takes <image> [<elf>] in place of <input> <output>.\n");
     printf("  -h         Print help information.\n");
     printf("  -V         Print version information.\n");
     printf("  -v         Enable verbose logging.\n");
@@ -129,17 +189,98 @@ typedef struct {
     const void *source;
     uint32_t offset;
     uint32_t length;
-    bool managed;
     uint32_t reserve_at_end;
 } copy_entry_t;
 
+#define ARENA_BLOCK_SIZE (256 * 1024)
+
+typedef struct arena_block {
+    struct arena_block *next;
+    size_t used;
+    size_t size;
+    uint8_t data[];
+} arena_block_t;
+
+// Holds packed section data until the image is written, then is released
+// in one go.
+typedef struct {
+    arena_block_t *head;
+} arena_t;
+
+static void *arena_alloc(arena_t *arena, size_t size) {
+    size = (size + 3) & ~3;
+    if (arena->head == NULL || arena->head->used + size > arena->head->size) {
+        size_t block_size = MAX(size, ARENA_BLOCK_SIZE);
+        arena_block_t *block = checked_malloc(sizeof(arena_block_t) + block_size);
+        block->next = arena->head;
+        block->used = 0;
+        block->size = block_size;
+        arena->head = block;
+    }
+    void *buffer = arena->head->data + arena->head->used;
+    arena->head->used += size;
+    return buffer;
+}
+
+static void arena_free(arena_t *arena) {
+    while (arena->head != NULL) {
+        arena_block_t *next = arena->head->next;
+        free(arena->head);
+        arena->head = next;
+    }
+}
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} buffer_t;
+
+// Returns a buffer of at least the given size; previous contents are lost.
+static uint8_t *buffer_reserve(buffer_t *buffer, size_t size) {
+    if (buffer->size < size) {
+        free(buffer->data);
+        buffer->data = checked_malloc(size);
+        buffer->size = size;
+    }
+    return buffer->data;
+}
+
+// Compressor workspace, reused across sections.
+typedef struct {
+    aplib_fast_ctx_t fast;
+    buffer_t packed[2];
+    buffer_t filtered;
+} compressor_t;
+
+static void compressor_free(compressor_t *compressor) {
+    aplib_fast_free(&compressor->fast);
+    free(compressor->packed[0].data);
+    free(compressor->packed[1].data);
+    free(compressor->filtered.data);
+    memset(compressor, 0, sizeof(compressor_t));
+}
+
 #define ELF_PT_PROCESSED 0x6ffffff0
+// Source of the leading command which holds the timing buffer address in
+// instrumented images.
+#define PROFILE_MAGIC 0x464F5250
 #define MAX_ENTRIES 1024
 
+typedef struct {
+    const void *source;
+    uint32_t dest;
+    uint32_t length;
+} loaded_entry_t;
+
 typedef struct {
     section_entry_t section_entries[MAX_ENTRIES];
     copy_entry_t copy_entries[MAX_ENTRIES];
     int entries_count;
+    // Sections loaded so far, for deduplication.
+    loaded_entry_t loaded_entries[MAX_ENTRIES];
+    int loaded_count;
+    compressor_t compressor;
+    arena_t arena;
 } pack_state_t;
                 
 static void checked_increment_entries_count(pack_state_t *state) {
@@ -151,6 +292,153 @@ static void checked_increment_entries_count(pack_state_t *state) {
 }
 
 
+static void policy_error(const char *filename, int line, const char *message, const char *token) {
+    fprintf(stderr, "%s:%d: %s \"%s\"\n", filename, line, message, token);
+    exit(1);
+}
+
+static void load_policy_file(const char *filename) {
+    FILE *fp = fopen(filename, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open \"%s\"!\n", filename);
+        exit(1);
+    }
+
+    char buffer[1024];
+    int line = 0;
+    while (fgets(buffer, sizeof(buffer), fp) != NULL) {
+        line++;
+        char *comment = strchr(buffer, '#');
+        if (comment != NULL) *comment = 0;
+
+        char *saveptr;
+        char *end;
+        char *token = strtok_r(buffer, " \t\r\n", &saveptr);
+        if (token == NULL) continue;
+
+        if (policy_rules_count >= MAX_POLICY_RULES) {
+            fprintf(stderr, "%s:%d: Too many rules!\n", filename, line);
+            exit(1);
+        }
+        policy_rule_t *rule = &policy_rules[policy_rules_count++];
+        memset(rule, 0, sizeof(policy_rule_t));
+
+        // The first token selects program headers, the rest are settings.
+        char *value = strchr(token, '=');
+        if (value == NULL) policy_error(filename, line, "Invalid match", token);
+        *(value++) = 0;
+        if (!strcmp(token, "addr")) {
+            rule->match_type = POLICY_MATCH_ADDRESS;
+            rule->start = strtoul(value, &end, 0);
+            rule->end = *end == '-' ? strtoul(end + 1, &end, 0) : rule->start;
+            if (*end || rule->end < rule->start) policy_error(filename, line, "Invalid address range", value);
+        } else if (!strcmp(token, "phdr")) {
+            rule->match_type = POLICY_MATCH_PHDR;
+            rule->phdr = strtol(value, &end, 0);
+            if (*end) policy_error(filename, line, "Invalid program header index", value);
+        } else if (!strcmp(token, "section")) {
+            rule->match_type = POLICY_MATCH_SECTION;
+            if (strlen(value) > MAX_POLICY_SECTION_NAME) policy_error(filename, line, "Section name too long", value);
+            strcpy(rule->section, value);
+        } else {
+            policy_error(filename, line, "Unknown match", token);
+        }
+
+        while ((token = strtok_r(NULL, " \t\r\n", &saveptr)) != NULL) {
+            value = strchr(token, '=');
+            if (value != NULL) *(value++) = 0;
+
+            if (!strcmp(token, "codec") && value != NULL) {
+                rule->set_mask |= POLICY_SET_CODEC;
+                if (!strcmp(value, "aplib")) rule->policy.codec = CODEC_APLIB;
+                else if (!strcmp(value, "lz77")) rule->policy.codec = CODEC_LZ77;
+                else if (!strcmp(value, "none")) rule->policy.codec = CODEC_NONE;
+                else policy_error(filename, line, "Unknown codec", value);
+            } else if (!strcmp(token, "level") && value != NULL) {
+                int level = strtol(value, &end, 0);
+                if (end == value || *end || level < 0 || level > COMPRESS_LEVEL_OPTIMAL) policy_error(filename, line, "Invalid level", value);
+                if (level == 0) {
+                    rule->set_mask |= POLICY_SET_CODEC;
+                    rule->policy.codec = CODEC_NONE;
+                } else {
+                    rule->set_mask |= POLICY_SET_LEVEL;
+                    rule->policy.level = level;
+                }
+            } else if (!strcmp(token, "window") && value != NULL) {
+                rule->set_mask |= POLICY_SET_WINDOW;
+                rule->policy.window_size = strtoul(value, &end, 0);
+                if (end == value || *end) policy_error(filename, line, "Invalid window size", value);
+            } else if (!strcmp(token, "raw") && value == NULL) {
+                rule->set_mask |= POLICY_SET_CODEC;
+                rule->policy.codec = CODEC_NONE;
+            } else if (!strcmp(token, "dedupe") && value == NULL) {
+                rule->set_mask |= POLICY_SET_DEDUPE;
+                rule->policy.dedupe = true;
+            } else if (!strcmp(token, "overlay") && value == NULL) {
+                rule->set_mask |= POLICY_SET_OVERLAY;
+                rule->policy.overlay = true;
+            } else {
+                policy_error(filename, line, "Unknown setting", token);
+            }
+        }
+
+        if (rule->policy.codec == CODEC_LZ77 && cue_lzss_path == NULL) {
+            fprintf(stderr, "%s:%d: codec=lz77 requires -L!\n", filename, line);
+            exit(1);
+        }
+    }
+
+    fclose(fp);
+}
+
+static bool phdr_contains_section(const uint8_t *input, int input_length, const elf_ehdr_t *ehdr, const elf_phdr_t *phdr, const char *name) {
+    // Section headers are optional; missing or malformed ones match nothing.
+    if (!ehdr->shnum || ehdr->shstrndx >= ehdr->shnum || ehdr->shentsize < sizeof(elf_shdr_t)
+        || (uint64_t) ehdr->shoff + (uint64_t) ehdr->shnum * ehdr->shentsize > (uint64_t) input_length) return false;
+    const elf_shdr_t *strtab = (const elf_shdr_t*) (input + ehdr->shoff + ehdr->shstrndx * ehdr->shentsize);
+    if ((uint64_t) strtab->offset + strtab->size > (uint64_t) input_length) return false;
+
+    // Compare the terminator too, so names must match exactly.
+    size_t name_length = strlen(name) + 1;
+    for (int i = 0; i < ehdr->shnum; i++) {
+        const elf_shdr_t *shdr = (const elf_shdr_t*) (input + ehdr->shoff + i * ehdr->shentsize);
+        if (!(shdr->flags & ELF_SHF_ALLOC) || !shdr->size) continue;
+        if (shdr->addr < phdr->vaddr || shdr->addr >= phdr->vaddr + phdr->memsz) continue;
+        if (shdr->name >= strtab->size || strtab->size - shdr->name < name_length) continue;
+        if (!memcmp(input + strtab->offset + shdr->name, name, name_length)) return true;
+    }
+    return false;
+}
+
+// Apply all rules matching a program header, in file order, on top of the
+// given policy. ehdr is NULL for .gba input.
+static void apply_section_policy(section_policy_t *policy, const uint8_t *input, int input_length, const elf_ehdr_t *ehdr, int phdr_index, uint32_t address) {
+    const elf_phdr_t *phdr = ehdr != NULL ? (const elf_phdr_t*) (input + (ehdr->phoff + phdr_index * ehdr->phentsize)) : NULL;
+
+    for (int i = 0; i < policy_rules_count; i++) {
+        const policy_rule_t *rule = &policy_rules[i];
+        bool matches = false;
+        switch (rule->match_type) {
+        case POLICY_MATCH_ADDRESS:
+            matches = address >= rule->start && address <= rule->end;
+            break;
+        case POLICY_MATCH_PHDR:
+            matches = phdr != NULL && rule->phdr == phdr_index;
+            break;
+        case POLICY_MATCH_SECTION:
+            matches = phdr != NULL && phdr_contains_section(input, input_length, ehdr, phdr, rule->section);
+            break;
+        }
+        if (!matches) continue;
+
+        if (rule->set_mask & POLICY_SET_CODEC) policy->codec = rule->policy.codec;
+        if (rule->set_mask & POLICY_SET_LEVEL) policy->level = rule->policy.level;
+        if (rule->set_mask & POLICY_SET_WINDOW) policy->window_size = rule->policy.window_size;
+        if (rule->set_mask & POLICY_SET_DEDUPE) policy->dedupe = rule->policy.dedupe;
+        if (rule->set_mask & POLICY_SET_OVERLAY) policy->overlay = rule->policy.overlay;
+    }
+}
+
 #define BIOS_MODE_COPY 0
 #define BIOS_MODE_FILL (1 << 24)
 #define BIOS_UNIT_HALFWORDS 0
@@ -188,6 +476,113 @@ static void append_bios_copy_section(pack_state_t *state, const void *source, ui
     checked_increment_entries_count(state);
 }
 
+static int compress_aplib(compressor_t *compressor, const void *source, void *packed, uint32_t length, size_t packed_buffer_size, uint32_t window_size, int level) {
+    if (level == COMPRESS_LEVEL_FAST) {
+        return aplib_fast_compress_ctx(&compressor->fast, source, packed, length, packed_buffer_size, window_size);
+    } else {
+        return apultra_compress(source, packed, length, packed_buffer_size, 0, window_size, 0, NULL, NULL);
+    }
+}
+
+#define ESTIMATE_BLOCK_SIZE 4096
+#define ESTIMATE_BLOCK_COUNT 16
+#define ESTIMATE_HASH_BITS 12
+// Approximate aPLib costs, in bits, used by the estimate below.
+#define ESTIMATE_LITERAL_BITS 9
+#define ESTIMATE_MATCH_BITS 20
+// Data below this order-0 entropy is always worth compressing.
+#define ESTIMATE_MIN_ENTROPY 7.0
+
+// Cheaply predict whether compressing data is worthwhile, by probing
+// evenly spaced sample blocks for byte entropy and short-range matches.
+static bool data_is_incompressible(const uint8_t *source, uint32_t length, const char *filter_name) {
+    uint32_t histogram[256];
+    uint16_t hash_table[1 << ESTIMATE_HASH_BITS];
+    uint32_t block_count = (length + ESTIMATE_BLOCK_SIZE - 1) / ESTIMATE_BLOCK_SIZE;
+    uint32_t block_step = (block_count + ESTIMATE_BLOCK_COUNT - 1) / ESTIMATE_BLOCK_COUNT;
+    uint32_t sampled = 0;
+    uint64_t estimated_bits = 0;
+    memset(histogram, 0, sizeof(histogram));
+
+    for (uint32_t block = 0; block < block_count; block += block_step) {
+        const uint8_t *data = source + block * ESTIMATE_BLOCK_SIZE;
+        uint32_t data_length = MIN(ESTIMATE_BLOCK_SIZE, length - block * ESTIMATE_BLOCK_SIZE);
+        memset(hash_table, 0xFF, sizeof(hash_table));
+
+        for (uint32_t i = 0; i < data_length; i++) histogram[data[i]]++;
+        sampled += data_length;
+
+        uint32_t i = 0;
+        while (i < data_length) {
+            if (i + 4 <= data_length) {
+                uint32_t v = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16) | ((uint32_t) data[i + 3] << 24);
+                uint32_t h = (v * 2654435761U) >> (32 - ESTIMATE_HASH_BITS);
+                uint16_t candidate = hash_table[h];
+                hash_table[h] = i;
+                if (candidate != 0xFFFF && !memcmp(data + candidate, data + i, 4)) {
+                    uint32_t match_length = 4;
+                    while (i + match_length < data_length && data[candidate + match_length] == data[i + match_length]) match_length++;
+                    estimated_bits += ESTIMATE_MATCH_BITS;
+                    i += match_length;
+                    continue;
+                }
+            }
+            estimated_bits += ESTIMATE_LITERAL_BITS;
+            i++;
+        }
+    }
+
+    double entropy = 0.0;
+    for (int i = 0; i < 256; i++) {
+        if (histogram[i]) {
+            double p = (double) histogram[i] / sampled;
+            entropy -= p * log2(p);
+        }
+    }
+    uint32_t estimated_ratio = estimated_bits * 100 / (sampled * 8);
+
+    if (verbose) {
+        printf("-> Estimated %d%% of original size (entropy %.2f bits/byte)", estimated_ratio, entropy);
+        if (filter_name != NULL) printf(" with %s filter", filter_name);
+        printf("\n");
+    }
+    return entropy >= ESTIMATE_MIN_ENTROPY && estimated_ratio > incompressible_threshold;
+}
+
+// Reversible filters tried on VRAM data before compression; undone by the
+// matching BIOS unfilter call when copying from EWRAM to VRAM.
+#define VRAM_FILTER_NONE 0
+#define VRAM_FILTER_DIFF8 1
+#define VRAM_FILTER_DIFF16 2
+#define VRAM_FILTER_COUNT 3
+
+#define BIOS_FILTER_DIFF8 0x81
+#define BIOS_FILTER_DIFF16 0x82
+
+static const char *vram_filter_names[VRAM_FILTER_COUNT] = {"none", "Diff8", "Diff16"};
+
+// Writes the data with the BIOS differential filter header prepended to
+// a buffer of at least length + 4 bytes, returning the filtered length.
+static uint32_t apply_vram_filter(const uint8_t *source, uint32_t length, int filter, uint8_t *filtered) {
+    *((uint32_t*) filtered) = (length << 8) | (filter == VRAM_FILTER_DIFF16 ? BIOS_FILTER_DIFF16 : BIOS_FILTER_DIFF8);
+    if (filter == VRAM_FILTER_DIFF16) {
+        const uint16_t *src16 = (const uint16_t*) source;
+        uint16_t *dst16 = (uint16_t*) (filtered + 4);
+        uint16_t prev = 0;
+        for (uint32_t i = 0; i < (length >> 1); i++) {
+            dst16[i] = src16[i] - prev;
+            prev = src16[i];
+        }
+    } else {
+        uint8_t prev = 0;
+        for (uint32_t i = 0; i < length; i++) {
+            filtered[i + 4] = source[i] - prev;
+            prev = source[i];
+        }
+    }
+    return length + 4;
+}
+
 // Decompress data directly
 #define COMPRESS_MODE_NORMAL 1
 // Copy data to end of EWRAM, then decompress in EWRAM
@@ -195,11 +590,75 @@ static void append_bios_copy_section(pack_state_t *state, const void *source, ui
 // Decompress data to end of EWRAM, then BIOS copy to VRAM
 #define COMPRESS_MODE_VRAM_COPY 3
 
-static void append_try_compress_section(pack_state_t *state, const void *source, uint32_t destination, uint32_t length, uint32_t window_size, int compress_mode) {
+static bool append_dedupe_section(pack_state_t *state, const void *source, uint32_t destination, uint32_t length) {
+    if (length & 1) return false;
+    for (int i = 0; i < state->loaded_count; i++) {
+        loaded_entry_t *entry = &state->loaded_entries[i];
+        if (entry->length == length && !memcmp(entry->source, source, length)) {
+            if (verbose) printf("-> Duplicate of data at %08X, copying\n", entry->dest);
+            state->section_entries[state->entries_count].source = entry->dest;
+            state->section_entries[state->entries_count].dest = destination;
+            state->section_entries[state->entries_count].flags = (length & 3)
+                ? ((length >> 1) | BIOS_MODE_COPY | BIOS_UNIT_HALFWORDS)
+                : ((length >> 2) | BIOS_MODE_COPY | BIOS_UNIT_WORDS);
+            checked_increment_entries_count(state);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void append_try_compress_section(pack_state_t *state, const void *source, uint32_t destination, uint32_t length, const section_policy_t *policy, int compress_mode) {
+    if (policy->dedupe && append_dedupe_section(state, source, destination, length)) {
+        return;
+    }
+    state->loaded_entries[state->loaded_count].source = source;
+    state->loaded_entries[state->loaded_count].dest = destination;
+    state->loaded_entries[state->loaded_count].length = length;
+    state->loaded_count++;
+
+    if (policy->codec == CODEC_NONE || (compress_mode == COMPRESS_MODE_VRAM_COPY && (length & 1))) {
+        // VRAM is written in halfwords at minimum; leave odd lengths to the
+        // plain copy path, which reports them.
+        compress_mode = 0;
+    }
+    int level = policy->level ? policy->level : compress_level;
+    bool use_lz77 = policy->codec == CODEC_LZ77
+        || (policy->codec == CODEC_DEFAULT && compress_mode == COMPRESS_MODE_VRAM_COPY && cue_lzss_path != NULL);
+    if (use_lz77 && compress_mode == COMPRESS_MODE_EWRAM_FINAL) {
+        // In-place extraction is only supported by the aPLib decoder.
+        if (verbose) printf("-> LZ77 not supported for EWRAM data, using aPLib\n");
+        use_lz77 = false;
+    }
+    if (use_lz77 && (length & 1)) {
+        // The BIOS VRAM decoder writes halfwords, so it cannot store the last byte.
+        if (verbose) printf("-> LZ77 not supported for odd-length data, using aPLib\n");
+        use_lz77 = false;
+    }
+
+    if (compress_mode && incompressible_threshold > 0) {
+        bool incompressible = data_is_incompressible(source, length, NULL);
+        // A VRAM filter may still make the data compressible.
+        if (compress_mode == COMPRESS_MODE_VRAM_COPY && !use_lz77) {
+            uint8_t *filtered = buffer_reserve(&state->compressor.filtered, length + 4);
+            for (int i = VRAM_FILTER_NONE + 1; incompressible && i < VRAM_FILTER_COUNT; i++) {
+                uint32_t filtered_length = apply_vram_filter(source, length, i, filtered);
+                incompressible = data_is_incompressible(filtered, filtered_length, vram_filter_names[i]);
+            }
+        }
+        if (incompressible) {
+            if (verbose) printf("-> Section estimated incompressible, not compressing\n");
+            compress_mode = 0;
+        }
+    }
+
     if (compress_mode) {
-        void *packed;
-        int result;
-        if (compress_mode == COMPRESS_MODE_VRAM_COPY && cue_lzss_path != NULL) {
+        compressor_t *compressor = &state->compressor;
+        uint8_t *packed = NULL;
+        uint8_t *lz77_packed = NULL;
+        int result = -1;
+        int vram_filter = VRAM_FILTER_NONE;
+        if (use_lz77) {
             char tmp_in[256+1];
             char tmp_out[256+1];
             char command[4096+1];
@@ -213,44 +672,74 @@ static void append_try_compress_section(pack_state_t *state, const void *source,
                 fprintf(stderr, "Error running \"%s\"\n", cue_lzss_path);
                 exit(1);
             }
-            packed = read_file(tmp_out, &result);
+            packed = lz77_packed = read_file(tmp_out, &result);
+        } else if (compress_mode == COMPRESS_MODE_VRAM_COPY) {
+            // Try each filter, keeping the smallest compressed result.
+            // The best result so far is kept in one scratch buffer while the
+            // next filter is compressed into the other.
+            size_t packed_buffer_size = apultra_get_max_compressed_size(length + 4);
+            uint8_t *filtered = buffer_reserve(&compressor->filtered, length + 4);
+            int best = 0;
+            for (int i = 0; i < VRAM_FILTER_COUNT; i++) {
+                uint32_t filtered_length = i == VRAM_FILTER_NONE ? length : apply_vram_filter(source, length, i, filtered);
+                uint8_t *filter_packed = buffer_reserve(&compressor->packed[packed == NULL ? best : !best], packed_buffer_size);
+                int filter_result = compress_aplib(compressor, i == VRAM_FILTER_NONE ? source : filtered, filter_packed, filtered_length, packed_buffer_size, policy->window_size, level);
+
+                if (verbose && filter_result >= 0) printf("-> Filter %s: %d -> %d bytes\n", vram_filter_names[i], length, filter_result);
+                if (packed == NULL || (filter_result >= 0 && (result < 0 || filter_result < result))) {
+                    if (packed != NULL) best = !best;
+                    packed = filter_packed;
+                    result = filter_result;
+                    vram_filter = i;
+                }
+            }
         } else {
             size_t packed_buffer_size = apultra_get_max_compressed_size(length);
-            packed = checked_malloc(packed_buffer_size);
-            result = apultra_compress(source, packed, length, packed_buffer_size, 0, window_size, 0, NULL, NULL);
+            packed = buffer_reserve(&compressor->packed[0], packed_buffer_size);
+            result = compress_aplib(compressor, source, packed, length, packed_buffer_size, policy->window_size, level);
         }
         if (result >= 0 && result < length) {
-            if (result > 0 && verbose) printf("-> Compressed %d -> %d bytes\n", length, result);
-            if (compress_mode == COMPRESS_MODE_VRAM_COPY && cue_lzss_path == NULL) {
-                if (!(length & 3)) {
-                    fprintf(stderr, "VRAM section not aligned to 4!\n");
-                    exit(1);
-                }
+            // Move the result out of the scratch buffers.
+            void *stored = arena_alloc(&state->arena, result);
+            memcpy(stored, packed, result);
+            free(lz77_packed);
+            packed = stored;
 
-                uint32_t intermediary_location = AGB_EWRAM_END + 1 - length;
+            if (result > 0 && verbose) printf("-> Compressed %d -> %d bytes\n", length, result);
+            if (compress_mode == COMPRESS_MODE_VRAM_COPY && !use_lz77) {
+                uint32_t unpacked_length = vram_filter == VRAM_FILTER_NONE ? length : length + 4;
+                // Keep the staged data word-aligned for the BIOS calls.
+                uint32_t intermediary_location = (AGB_EWRAM_END + 1 - unpacked_length) & ~3;
+                if (vram_filter != VRAM_FILTER_NONE && verbose) printf("-> Using %s filter\n", vram_filter_names[vram_filter]);
 
                 state->section_entries[state->entries_count].source = 0;
                 state->section_entries[state->entries_count].dest = intermediary_location;
                 state->section_entries[state->entries_count].flags = result | (1 << 31);
                 state->copy_entries[state->entries_count].source = packed;
                 state->copy_entries[state->entries_count].length = result;
-                state->copy_entries[state->entries_count].managed = true;
-                state->copy_entries[state->entries_count].reserve_at_end = length;
+                state->copy_entries[state->entries_count].reserve_at_end = AGB_EWRAM_END + 1 - intermediary_location;
                 checked_increment_entries_count(state);
 
                 state->section_entries[state->entries_count].source = intermediary_location;
                 state->section_entries[state->entries_count].dest = destination;
-                state->section_entries[state->entries_count].flags = (length >> 2) | BIOS_MODE_COPY | BIOS_UNIT_WORDS;
+                if (vram_filter == VRAM_FILTER_DIFF16) {
+                    state->section_entries[state->entries_count].flags = (1 << 28);
+                } else if (vram_filter == VRAM_FILTER_DIFF8) {
+                    state->section_entries[state->entries_count].flags = (1 << 27);
+                } else if (length & 3) {
+                    state->section_entries[state->entries_count].flags = (length >> 1) | BIOS_MODE_COPY | BIOS_UNIT_HALFWORDS;
+                } else {
+                    state->section_entries[state->entries_count].flags = (length >> 2) | BIOS_MODE_COPY | BIOS_UNIT_WORDS;
+                }
                 checked_increment_entries_count(state);
             } else {
                 state->section_entries[state->entries_count].source = 0;
                 state->section_entries[state->entries_count].dest = destination;
                 state->section_entries[state->entries_count].flags =
                     compress_mode == COMPRESS_MODE_EWRAM_FINAL ? ((1 << 30) | ((result + 31) & ~31))
-                    : (compress_mode == COMPRESS_MODE_VRAM_COPY ? ((1 << 29) | result) : ((1 << 31) | result));
+                    : (use_lz77 ? ((1 << 29) | result) : ((1 << 31) | result));
                 state->copy_entries[state->entries_count].source = packed;
                 state->copy_entries[state->entries_count].length = result;
-                state->copy_entries[state->entries_count].managed = true;
                 state->copy_entries[state->entries_count].reserve_at_end = compress_mode == COMPRESS_MODE_EWRAM_FINAL ? 32 : 0;
                 checked_increment_entries_count(state);
             }
@@ -258,7 +747,7 @@ static void append_try_compress_section(pack_state_t *state, const void *source,
         } else {
             if (result < 0 && verbose) printf("-> Section compression error (%d)\n", result);
             if (result > 0 && verbose) printf("-> Compressed section larger than uncompressed (%d > %d), ignoring\n", result, length);
-            free(packed);
+            free(lz77_packed);
         }
     }
 
@@ -266,6 +755,124 @@ static void append_try_compress_section(pack_state_t *state, const void *source,
     append_bios_copy_section(state, source, destination, length, false);
 }
 
+static inline bool ranges_overlap(uint32_t a_start, uint32_t a_length, uint32_t b_start, uint32_t b_length) {
+    return a_start < b_start + b_length && b_start < a_start + a_length;
+}
+
+// Returns the codec name and stored data size of a command; size is zero if
+// only known at runtime.
+static const char *describe_command(const section_entry_t *entry, uint32_t *size) {
+    if (entry->flags & (1 << 30)) {
+        *size = entry->flags & 0xFFFFFF;
+        return "aPLib (moved)";
+    } else if (entry->flags & (1 << 31)) {
+        *size = entry->flags & 0xFFFFFF;
+        return "aPLib";
+    } else if (entry->flags & (1 << 28)) {
+        *size = 0;
+        return "Diff16";
+    } else if (entry->flags & (1 << 27)) {
+        *size = 0;
+        return "Diff8";
+    } else if (entry->flags & (1 << 29)) {
+        *size = entry->flags & 0xFFFFFF;
+        return "LZ77 (VRAM)";
+    } else {
+        *size = (entry->flags & 0x1FFFFF) << ((entry->flags & BIOS_UNIT_WORDS) ? 2 : 1);
+        return (entry->flags & BIOS_MODE_FILL) ? "BIOS fill" : "BIOS copy";
+    }
+}
+
+static bool elf_is_supported(const uint8_t *input, int input_length) {
+    const elf_ehdr_t *ehdr = (const elf_ehdr_t*) input;
+    return input_length >= (int) sizeof(elf_ehdr_t)
+        && ehdr->i_magic == ELF_MAGIC
+        && ehdr->i_class == ELF_ELFCLASS32
+        && ehdr->i_data == ELF_ELFDATA2LSB
+        && ehdr->type == ELF_ET_EXEC
+        && ehdr->machine == ELF_EM_ARM
+        && ehdr->version == ELF_EV_CURRENT
+        && (!ehdr->phnum || ehdr->phentsize >= sizeof(elf_phdr_t))
+        && (uint64_t) ehdr->phoff + (uint64_t) ehdr->phnum * ehdr->phentsize <= (uint64_t) input_length;
+}
+
+static int print_profile_report(const char *dump_path, const char *image_path, const char *elf_path) {
+    int image_length, dump_length;
+    uint8_t *image = read_file(image_path, &image_length);
+    uint8_t *dump = read_file(dump_path, &dump_length);
+    int elf_length = 0;
+    uint8_t *elf = elf_path ? read_file(elf_path, &elf_length) : NULL;
+    if (elf != NULL && !elf_is_supported(elf, elf_length)) {
+        fprintf(stderr, "Unsupported file \"%s\"!\n", elf_path);
+        exit(1);
+    }
+
+    // The last word of the image is the negative offset to the command stream length.
+    int64_t stream_offset = -1;
+    uint32_t entries_count = 0;
+    if (image_length >= 16) {
+        stream_offset = (int64_t) image_length + *((int32_t*) (image + image_length - 4));
+    }
+    if (stream_offset >= 0 && stream_offset <= image_length - 4) {
+        entries_count = *((uint32_t*) (image + stream_offset)) / 3;
+    }
+    if (stream_offset < 0 || stream_offset + 4 + (int64_t) (entries_count * sizeof(section_entry_t)) > (int64_t) image_length) {
+        fprintf(stderr, "Could not locate command stream in \"%s\"!\n", image_path);
+        exit(1);
+    }
+    const section_entry_t *entries = (const section_entry_t*) (image + stream_offset + 4);
+    if (entries_count < 2 || entries[0].source != PROFILE_MAGIC) {
+        fprintf(stderr, "\"%s\" is not an instrumented image!\n", image_path);
+        exit(1);
+    }
+    // One timestamp is stored before each command, including the final branch.
+    entries++;
+    entries_count--;
+    const uint32_t *timings = (const uint32_t*) dump;
+    if ((uint32_t) dump_length < entries_count * 4) {
+        fprintf(stderr, "Memory dump too small: %d < %d bytes\n", dump_length, entries_count * 4);
+        exit(1);
+    }
+
+    elf_ehdr_t *ehdr = (elf_ehdr_t*) elf;
+    printf("Timing buffer at %08X, %u commands\n\n", entries[-1].dest, entries_count - 1);
+    printf("   #  Codec          Dest      Size     Cycles      ms  Program header\n");
+    uint32_t total_cycles = 0;
+    for (uint32_t i = 0; i < entries_count - 1; i++) {
+        uint32_t size;
+        const char *codec = describe_command(&entries[i], &size);
+        uint32_t cycles = timings[i + 1] - timings[i];
+        total_cycles += cycles;
+
+        printf("%4u  %-13s  %08X  ", i, codec, entries[i].dest);
+        if (size) printf("%7d", size);
+        else printf("%7s", "-");
+        printf("  %9u  %6.2f", cycles, cycles / AGB_CYCLES_PER_MS);
+
+        // Data staged at the end of EWRAM belongs to the following command.
+        uint32_t address = entries[i].dest;
+        bool staged = entries[i + 1].source == address;
+        if (staged) address = entries[i + 1].dest;
+        if (ehdr != NULL) {
+            for (int j = 0; j < ehdr->phnum; j++) {
+                elf_phdr_t *phdr = (elf_phdr_t*) (elf + (ehdr->phoff + j * ehdr->phentsize));
+                if (phdr_supports_type(phdr->type) && address >= phdr->paddr && address < phdr->paddr + phdr->memsz) {
+                    printf("  %d", j);
+                    break;
+                }
+            }
+        }
+        if (staged) printf(" (staging)");
+        printf("\n");
+    }
+    printf("\nTotal: %u cycles, %.2f ms\n", total_cycles, total_cycles / AGB_CYCLES_PER_MS);
+
+    free(elf);
+    free(dump);
+    free(image);
+    return 0;
+}
+
 int main(int argc, char **argv) {
     pack_state_t state;
     memset(&state, 0, sizeof(pack_state_t));
@@ -273,14 +880,39 @@ int main(int argc, char **argv) {
     // === Parse arguments ===
 
     bool compress = true;
+    bool profile = false;
+    uint32_t profile_address = 0;
+    const char *report_path = NULL;
     int c;
-    while ((c = getopt(argc, argv, "0L:hVv")) != -1) switch (c) {
+    char *end;
+    const char *policy_path = NULL;
+    while ((c = getopt(argc, argv, "01L:P:p:R:t:hVv")) != -1) switch (c) {
     case '0':
         compress = false;
         break;
+    case '1':
+        compress_level = COMPRESS_LEVEL_FAST;
+        break;
     case 'L':
         cue_lzss_path = optarg;
         break;
+    case 'P':
+        policy_path = optarg;
+        break;
+    case 'p':
+        profile = true;
+        profile_address = strtoul(optarg, NULL, 0);
+        break;
+    case 'R':
+        report_path = optarg;
+        break;
+    case 't':
+        incompressible_threshold = strtol(optarg, &end, 10);
+        if (end == optarg || *end || incompressible_threshold < 0) {
+            fprintf(stderr, "Invalid threshold \"%s\"!\n", optarg);
+            exit(1);
+        }
+        break;
     case 'h':
         print_help(argc, argv);
         return 0;
@@ -292,11 +924,28 @@ int main(int argc, char **argv) {
         break;
     }
 
+    if (report_path != NULL) {
+        if ((argc - optind) < 1 || (argc - optind) > 2) {
+            print_help(argc, argv);
+            return 0;
+        }
+        return print_profile_report(report_path, argv[optind], (argc - optind) == 2 ? argv[optind + 1] : NULL);
+    }
+
     if ((argc - optind) != 2) {
         print_help(argc, argv);
         return 0;
     }
 
+    if (policy_path != NULL) {
+        load_policy_file(policy_path);
+    }
+
+    if (profile && ((profile_address & 3) || !address_supports_8bit_writes(profile_address))) {
+        fprintf(stderr, "Timing buffer must be word-aligned and in EWRAM or IWRAM!\n");
+        exit(1);
+    }
+
     srand(time(NULL));
     if (verbose) print_version();
 
@@ -326,14 +975,7 @@ int main(int argc, char **argv) {
             exit(1);
         }
     } else {
-        if (input_length < sizeof(elf_ehdr_t)
-            || ehdr->i_magic != ELF_MAGIC
-            || ehdr->i_class != ELF_ELFCLASS32
-            || ehdr->i_data != ELF_ELFDATA2LSB
-            || ehdr->type != ELF_ET_EXEC
-            || ehdr->machine != ELF_EM_ARM
-            || ehdr->version != ELF_EV_CURRENT)
-        {
+        if (!elf_is_supported(input, input_length)) {
             fprintf(stderr, "Unsupported file!\n");
             exit(1);
         }
@@ -380,8 +1022,10 @@ int main(int argc, char **argv) {
     fseek(outf, 0, SEEK_END);
     uint32_t rom_loader_offset = ftell(outf);
 
-    const void *bootstrap_data = is_multiboot ? (compress ? bootstrap_multiboot : bootstrap_multiboot_nopack) : (compress ? bootstrap_rom : bootstrap_rom_nopack);
-    size_t bootstrap_size = is_multiboot ? (compress ? bootstrap_multiboot_size : bootstrap_multiboot_nopack_size) : (compress ? bootstrap_rom_size : bootstrap_rom_nopack_size);
+    const void *bootstrap_data = is_multiboot ? (profile ? bootstrap_multiboot_profile : (compress ? bootstrap_multiboot : bootstrap_multiboot_nopack))
+        : (profile ? bootstrap_rom_profile : (compress ? bootstrap_rom : bootstrap_rom_nopack));
+    size_t bootstrap_size = is_multiboot ? (profile ? bootstrap_multiboot_profile_size : (compress ? bootstrap_multiboot_size : bootstrap_multiboot_nopack_size))
+        : (profile ? bootstrap_rom_profile_size : (compress ? bootstrap_rom_size : bootstrap_rom_nopack_size));
     checked_fwrite(bootstrap_data, bootstrap_size, outf);
 
     // - Copy logo/header data
@@ -395,16 +1039,46 @@ int main(int argc, char **argv) {
 
     // - Write data streams
 
+    if (profile) {
+        // The instrumented bootstrap reads the timing buffer address first.
+        state.section_entries[state.entries_count].source = PROFILE_MAGIC;
+        state.section_entries[state.entries_count].dest = profile_address;
+        checked_increment_entries_count(&state);
+    }
+
     if (is_raw) {
         // Write just one area.
         uint32_t ewram_offset = 0xC8;
 
+        section_policy_t policy = {0};
+        apply_section_policy(&policy, input, input_length, NULL, -1, AGB_EWRAM_START + ewram_offset);
+
         if (verbose) printf("Compressing EWRAM data (%08X - %08X)\n", AGB_EWRAM_START + ewram_offset, AGB_EWRAM_START + input_length);
-        append_try_compress_section(&state, input + ewram_offset, AGB_EWRAM_START + ewram_offset, input_length - ewram_offset, 0, COMPRESS_MODE_EWRAM_FINAL);
+        append_try_compress_section(&state, input + ewram_offset, AGB_EWRAM_START + ewram_offset, input_length - ewram_offset, &policy, COMPRESS_MODE_EWRAM_FINAL);
     }
 
     if (is_elf) {
-        // First, write areas which don't support 8-bit writes.
+        // First, skip overlays, which are initialized by the program itself.
+        // ROM program headers have already been written; any remaining one
+        // with file data would have nowhere to be loaded from.
+        for (int i = 0; i < ehdr->phnum; i++) {
+            elf_phdr_t *phdr = (elf_phdr_t*) (input + (ehdr->phoff + i * ehdr->phentsize));
+            if (phdr->type == ELF_PT_PROCESSED) continue;
+            if (!phdr_supports_type(phdr->type)) continue;
+
+            section_policy_t policy = {0};
+            apply_section_policy(&policy, input, input_length, ehdr, i, phdr->paddr);
+            if (policy.overlay) {
+                if (phdr->filesz) {
+                    fprintf(stderr, "Program header %d has data outside ROM, cannot be an overlay!\n", i);
+                    exit(1);
+                }
+                if (verbose) printf("Skipping program header %d (overlay)\n", i);
+                phdr->type = ELF_PT_PROCESSED;
+            }
+        }
+
+        // Next, write areas which don't support 8-bit writes.
         for (int i = 0; i < ehdr->phnum; i++) {
             elf_phdr_t *phdr = (elf_phdr_t*) (input + (ehdr->phoff + i * ehdr->phentsize));
             if (phdr->type == ELF_PT_PROCESSED) continue;
@@ -420,8 +1094,11 @@ int main(int argc, char **argv) {
             }
 
             if (phdr->filesz && !address_supports_8bit_writes(phdr->paddr)) {
+                section_policy_t policy = {0};
+                apply_section_policy(&policy, input, input_length, ehdr, i, phdr->paddr);
+
                 if (verbose) printf("Processing program header %d (data)\n", i);
-                append_try_compress_section(&state, input + phdr->offset, phdr->paddr, phdr->filesz, 0, compress ? COMPRESS_MODE_VRAM_COPY : 0);
+                append_try_compress_section(&state, input + phdr->offset, phdr->paddr, phdr->filesz, &policy, compress ? COMPRESS_MODE_VRAM_COPY : 0);
                 phdr->type = ELF_PT_PROCESSED;
             }
         }
@@ -431,6 +1108,7 @@ int main(int argc, char **argv) {
         uint8_t ewram_data[AGB_EWRAM_SIZE];
         uint32_t ewram_data_start = AGB_EWRAM_END + 1;
         uint32_t ewram_data_end = AGB_EWRAM_START - 1;
+        section_policy_t ewram_policy = {0};
         memset(ewram_data, 0, sizeof(ewram_data));
 
         for (int i = 0; i < ehdr->phnum; i++) {
@@ -441,6 +1119,7 @@ int main(int argc, char **argv) {
             if (is_multiboot && address_is_ewram(phdr->paddr)) { 
                 if (phdr->filesz) {
                     if (verbose) printf("Appending program header %d to EWRAM data\n", i);
+                    apply_section_policy(&ewram_policy, input, input_length, ehdr, i, phdr->paddr);
                     memcpy(ewram_data + phdr->paddr - AGB_EWRAM_START, input + phdr->offset, phdr->filesz);
                     if (ewram_data_start > phdr->paddr) ewram_data_start = phdr->paddr;
                     if (ewram_data_end < (phdr->paddr + phdr->filesz - 1)) ewram_data_end = phdr->paddr + phdr->filesz - 1;
@@ -450,7 +1129,9 @@ int main(int argc, char **argv) {
             }
             if (verbose) printf("Processing program header %d (data)\n", i);
             if (phdr->filesz) {
-                append_try_compress_section(&state, input + phdr->offset, phdr->paddr, phdr->filesz, 0, compress ? COMPRESS_MODE_NORMAL : 0);
+                section_policy_t policy = {0};
+                apply_section_policy(&policy, input, input_length, ehdr, i, phdr->paddr);
+                append_try_compress_section(&state, input + phdr->offset, phdr->paddr, phdr->filesz, &policy, compress ? COMPRESS_MODE_NORMAL : 0);
             } else {
                 append_bios_copy_section(&state, NULL, phdr->paddr, phdr->memsz, true);
             }
@@ -460,7 +1141,7 @@ int main(int argc, char **argv) {
         // Next, copy EWRAM data.
         if (ewram_data_start <= AGB_EWRAM_END) {
             if (verbose) printf("Compressing EWRAM data (%08X - %08X)\n", ewram_data_start, ewram_data_end);
-            append_try_compress_section(&state, ewram_data + ewram_data_start - AGB_EWRAM_START, ewram_data_start, ewram_data_end + 1 - ewram_data_start, 0, compress ? COMPRESS_MODE_EWRAM_FINAL : 0);
+            append_try_compress_section(&state, ewram_data + ewram_data_start - AGB_EWRAM_START, ewram_data_start, ewram_data_end + 1 - ewram_data_start, &ewram_policy, compress ? COMPRESS_MODE_EWRAM_FINAL : 0);
         }
 
         // Next, fill EWRAM areas.
@@ -486,6 +1167,10 @@ int main(int argc, char **argv) {
     state.section_entries[state.entries_count].flags = -(((state.entries_count + 1) * sizeof(section_entry_t)) + 4);
     checked_increment_entries_count(&state);
 
+    if (profile) {
+        state.section_entries[0].flags = state.entries_count - 1;
+    }
+
     // Prepare data for the appended header.
     uint32_t copy_offset = (is_multiboot ? AGB_EWRAM_START : AGB_ROM_START) + ftell(outf) + 4;
     uint32_t rom_data_length = 0;
@@ -502,12 +1187,10 @@ int main(int argc, char **argv) {
 
             int remainder = ((state.copy_entries[i].length + 3) & ~3) - state.copy_entries[i].length;
             while (remainder--) fputc(0, outf);
-
-            if (state.copy_entries[i].managed) {
-                free((void*) state.copy_entries[i].source);
-            }
         }
     }
+    compressor_free(&state.compressor);
+    arena_free(&state.arena);
 
     uint32_t command_stream_length = state.entries_count * 3;
     checked_fwrite(&command_stream_length, 4, outf);
@@ -521,6 +1204,37 @@ int main(int argc, char **argv) {
         }
     }
 
+    if (profile) {
+        uint32_t profile_length = (state.entries_count - 1) * 4;
+        // Multiboot images relocate the command stream below stage2.
+        uint32_t stage2_start = AGB_PROFILE_STAGE2_ADDR - (is_multiboot ? state.entries_count * sizeof(section_entry_t) : 0);
+        bool overlap = ranges_overlap(profile_address, profile_length, stage2_start, AGB_IWRAM_END + 1 - stage2_start);
+        if (is_multiboot) {
+            overlap |= ranges_overlap(profile_address, profile_length, AGB_EWRAM_START, ftell(outf));
+        }
+        for (int i = 0; i < state.entries_count; i++) {
+            // Moved aPLib data is copied in full to the end of EWRAM first.
+            uint32_t tail_length = (state.section_entries[i].flags & (1 << 30))
+                ? (state.section_entries[i].flags & 0x0FFFFFFF)
+                : state.copy_entries[i].reserve_at_end;
+            overlap |= ranges_overlap(profile_address, profile_length, AGB_EWRAM_END + 1 - tail_length, tail_length);
+        }
+        if (is_raw) {
+            overlap |= ranges_overlap(profile_address, profile_length, AGB_EWRAM_START, input_length);
+        }
+        if (is_elf) {
+            for (int i = 0; i < ehdr->phnum; i++) {
+                elf_phdr_t *phdr = (elf_phdr_t*) (input + (ehdr->phoff + i * ehdr->phentsize));
+                overlap |= ranges_overlap(profile_address, profile_length, phdr->paddr, phdr->memsz);
+            }
+        }
+        if (overlap) {
+            fprintf(stderr, "Timing buffer %08X - %08X overlaps loaded data!\n", profile_address, profile_address + profile_length - 1);
+            exit(1);
+        }
+        if (verbose) printf("Timing buffer at %08X - %08X\n", profile_address, profile_address + profile_length - 1);
+    }
+
     // Patch entrypoint for ROM image.
     if (!is_multiboot) {
         fseek(outf, 0, SEEK_SET);